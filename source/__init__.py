@@ -0,0 +1,27 @@
+import os
+extdir = os.path.abspath(os.path.dirname(os.path.realpath(__file__))) 
+
+import sys
+sys.path.append(extdir)
+ 
+def Engine():
+ from libkorali import Engine
+ return Engine()
+
+def Experiment():
+ from libkorali import Experiment
+ return Experiment()
+ 
+def ExternalModel(command):
+ from libkorali import ExternalModel
+ return ExternalModel(command)
+
+def PluginModel(libraryPath, symbolName):
+ from libkorali import PluginModel
+ return PluginModel(libraryPath, symbolName)
+
+def getMPIComm():
+ from libkorali import getMPICommPointer
+ return getMPICommPointer()
+ 
+ 
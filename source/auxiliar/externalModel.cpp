@@ -0,0 +1,114 @@
+#include "auxiliar/externalModel.hpp"
+#include "experiment/sample/sample.hpp"
+#include <sys/wait.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <signal.h>
+
+korali::ExternalModel::ExternalModel(const std::vector<std::string>& command)
+{
+ if (command.empty()) korali::logError("External models require at least the path to an executable.\n");
+
+ _command = command;
+ _processId = 0;
+ _ownerProcessId = 0;
+ _input = nullptr;
+ _output = nullptr;
+}
+
+// Copies share the command only. Each copy launches its own process when first evaluated.
+korali::ExternalModel::ExternalModel(const ExternalModel& other) : ExternalModel(other._command) { }
+
+korali::ExternalModel::~ExternalModel()
+{
+ terminate();
+}
+
+void korali::ExternalModel::launch()
+{
+ int inputPipe[2];
+ int outputPipe[2];
+ if (pipe(inputPipe) == -1) korali::logError("Unable to create inter-process pipe. \n");
+ if (pipe(outputPipe) == -1) korali::logError("Unable to create inter-process pipe. \n");
+
+ // Keeping these pipes out of any other executable launched later, so it sees the end of its input when we exit
+ fcntl(inputPipe[1], F_SETFD, FD_CLOEXEC);
+ fcntl(outputPipe[0], F_SETFD, FD_CLOEXEC);
+
+ // A failing executable is reported when reading its output, instead of terminating us on write
+ signal(SIGPIPE, SIG_IGN);
+
+ pid_t processId = fork();
+ if (processId == -1) korali::logError("Unable to launch external model '%s'.\n", _command[0].c_str());
+
+ if (processId == 0)
+ {
+  dup2(inputPipe[0], STDIN_FILENO);
+  dup2(outputPipe[1], STDOUT_FILENO);
+  close(inputPipe[0]);
+  close(inputPipe[1]);
+  close(outputPipe[0]);
+  close(outputPipe[1]);
+
+  std::vector<char*> arguments;
+  for (size_t i = 0; i < _command.size(); i++) arguments.push_back(const_cast<char*>(_command[i].c_str()));
+  arguments.push_back(nullptr);
+
+  execvp(arguments[0], arguments.data());
+  fprintf(stderr, "[Korali] Error: Could not execute external model '%s'.\n", arguments[0]);
+  _exit(127);
+ }
+
+ close(inputPipe[0]);
+ close(outputPipe[1]);
+
+ _processId = processId;
+ _ownerProcessId = getpid();
+ _input = fdopen(inputPipe[1], "w");
+ _output = fdopen(outputPipe[0], "r");
+}
+
+void korali::ExternalModel::terminate()
+{
+ if (_processId == 0) return;
+
+ // A process forked after the launch only drops its copies of the pipes, the executable belongs to its parent
+ if (_ownerProcessId == getpid())
+ {
+  fclose(_input);
+  fclose(_output);
+  int status;
+  waitpid(_processId, &status, 0);
+ }
+ else
+ {
+  close(fileno(_input));
+  close(fileno(_output));
+ }
+
+ _processId = 0;
+ _input = nullptr;
+ _output = nullptr;
+}
+
+void korali::ExternalModel::operator()(korali::Sample& sample)
+{
+ if (_processId != 0 && _ownerProcessId != getpid()) terminate();
+ if (_processId == 0) launch();
+
+ auto& parameters = sample["Parameters"];
+ fprintf(_input, "%lu", parameters.size());
+ for (size_t i = 0; i < parameters.size(); i++) fprintf(_input, " %.17g", parameters[i].get<double>());
+ fprintf(_input, "\n");
+ fflush(_input);
+
+ std::string resultString;
+ int c;
+ while ((c = fgetc(_output)) != EOF && c != '\n') resultString += (char) c;
+ if (c == EOF) korali::logError("External model '%s' exited before returning its result.\n", _command[0].c_str());
+
+ auto results = nlohmann::json::parse(resultString, nullptr, false);
+ if (results.is_object() == false) korali::logError("External model '%s' returned an invalid result: '%s'. A JSON object was expected.\n", _command[0].c_str(), resultString.c_str());
+
+ for (auto& result : results.items()) sample[result.key()] = result.value();
+}
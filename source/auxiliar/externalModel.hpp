@@ -0,0 +1,40 @@
+#ifndef _KORALI_AUXILIARS_EXTERNALMODEL_HPP_
+#define _KORALI_AUXILIARS_EXTERNALMODEL_HPP_
+
+#include <sys/types.h>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+namespace korali
+{
+
+class Sample;
+
+// Model evaluated by an external executable that is launched once per worker process and kept running. For each
+// sample, the parameter count and values are written as a line to its standard input, and it is expected to answer
+// with a line containing a JSON object with the results (e.g., {"F(x)": 1.5}), which is merged into the sample.
+class ExternalModel
+{
+ public:
+
+ ExternalModel(const std::vector<std::string>& command);
+ ExternalModel(const ExternalModel& other);
+ ~ExternalModel();
+
+ std::vector<std::string> _command;
+
+ // Process running the executable (0 if not launched), and the process that launched it
+ pid_t _processId;
+ pid_t _ownerProcessId;
+ FILE* _input;
+ FILE* _output;
+
+ void operator()(korali::Sample& sample);
+ void launch();
+ void terminate();
+};
+
+}
+
+#endif
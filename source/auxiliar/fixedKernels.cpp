@@ -0,0 +1,66 @@
+#include "fixedKernels.hpp"
+#include <Eigen/Dense>
+
+template <int N> using FixedMatrix = Eigen::Matrix<double, N, N, Eigen::RowMajor>;
+template <int N> using FixedRows = Eigen::Matrix<double, Eigen::Dynamic, N, N == 1 ? Eigen::ColMajor : Eigen::RowMajor>;
+
+template <int N>
+bool fixedSymmetricEigen(const double* M, double* eigenvalues, double* Q)
+{
+ Eigen::Map<const FixedMatrix<N>> m(M);
+ Eigen::SelfAdjointEigenSolver<FixedMatrix<N>> solver(m);
+ if (solver.info() != Eigen::Success) return false;
+
+ Eigen::Map<Eigen::Matrix<double, N, 1>> d(eigenvalues);
+ Eigen::Map<FixedMatrix<N>> q(Q);
+ d = solver.eigenvalues();
+ q = solver.eigenvectors();
+ return true;
+}
+
+template <int N>
+bool fixedCholesky(const double* C, double* L)
+{
+ Eigen::Map<const FixedMatrix<N>> c(C);
+ Eigen::LLT<FixedMatrix<N>> llt(c);
+ if (llt.info() != Eigen::Success) return false;
+
+ Eigen::Map<FixedMatrix<N>> l(L);
+ l = llt.matrixL();
+ return true;
+}
+
+template <int N>
+void fixedMultiplyRows(size_t rows, const double* X, const double* A, double* Y)
+{
+ Eigen::Map<const FixedRows<N>> x(X, rows, N);
+ Eigen::Map<const FixedMatrix<N>> a(A);
+ Eigen::Map<FixedRows<N>> y(Y, rows, N);
+ y.noalias() = x * a.transpose();
+}
+
+// Instantiates the kernels for every size from N down to 1
+template <int N>
+struct FixedKernelDispatch
+{
+ static bool get(size_t size, korali::FixedKernels& kernels)
+ {
+  if (size != N) return FixedKernelDispatch<N-1>::get(size, kernels);
+
+  kernels.symmetricEigen = &fixedSymmetricEigen<N>;
+  kernels.cholesky = &fixedCholesky<N>;
+  kernels.multiplyRows = &fixedMultiplyRows<N>;
+  return true;
+ }
+};
+
+template <>
+struct FixedKernelDispatch<0>
+{
+ static bool get(size_t size, korali::FixedKernels& kernels) { return false; }
+};
+
+bool korali::getFixedKernels(size_t N, korali::FixedKernels& kernels)
+{
+ return FixedKernelDispatch<korali::MaxFixedKernelSize>::get(N, kernels);
+}
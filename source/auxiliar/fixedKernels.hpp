@@ -0,0 +1,32 @@
+#ifndef _KORALI_AUXILIARS_FIXEDKERNELS_HPP_
+#define _KORALI_AUXILIARS_FIXEDKERNELS_HPP_
+
+// Linear algebra kernels compiled for every dimension up to MaxFixedKernelSize. For small problems, the fixed sizes
+// let the compiler unroll the loops and keep the matrices off the heap, where generic kernels are dominated by their overhead.
+
+#include <stdlib.h>
+
+namespace korali
+{
+
+const size_t MaxFixedKernelSize = 16;
+
+// All matrices are N x N, dense and row-major
+struct FixedKernels
+{
+ // Eigenvalues of the symmetric matrix M in ascending order, and its eigenvectors in the columns of Q. Returns false if the solver failed.
+ bool (*symmetricEigen)(const double* M, double* eigenvalues, double* Q);
+
+ // Lower triangular L with C = L*L^T. Returns false, leaving L unchanged, if C is not positive definite.
+ bool (*cholesky)(const double* C, double* L);
+
+ // Y = X*A^T for X and Y with the given number of rows, i.e., y = A*x for every row
+ void (*multiplyRows)(size_t rows, const double* X, const double* A, double* Y);
+};
+
+// Returns false if N exceeds MaxFixedKernelSize
+bool getFixedKernels(size_t N, FixedKernels& kernels);
+
+}
+
+#endif // _KORALI_AUXILIARS_FIXEDKERNELS_HPP_
@@ -58,6 +58,33 @@ namespace korali
 
    return false;
  }
+
+ static bool loadFile(std::string& dst, const std::string filePath)
+ {
+   FILE *fid = fopen(filePath.c_str(), "rb");
+   if (fid == NULL) return false;
+
+   fseek(fid, 0, SEEK_END);
+   long fsize = ftell(fid);
+   fseek(fid, 0, SEEK_SET);
+
+   dst.resize(fsize);
+   size_t readSize = fread(&dst[0], 1, fsize, fid);
+   fclose(fid);
+
+   return readSize == (size_t) fsize;
+ }
+
+ static bool saveFile(const std::string filePath, const std::string& src)
+ {
+   FILE *fid = fopen(filePath.c_str(), "wb");
+   if (fid == NULL) return false;
+
+   size_t writeSize = fwrite(src.data(), 1, src.size(), fid);
+   fclose(fid);
+
+   return writeSize == src.size();
+ }
 }
 
 #endif // _AUXILIAR_FS_HPP_
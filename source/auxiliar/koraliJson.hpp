@@ -138,16 +138,24 @@ static void eraseValue(nlohmann::json& js, std::string path)
  aux->erase(settings[i]);
 }
 
-static bool isDefined(nlohmann::json& js, std::vector<std::string> settings)
+// Returns a pointer to the value at the given path, or NULL if it is not defined. Does not copy or create any node.
+static nlohmann::json* findValue(nlohmann::json& js, const std::vector<std::string>& settings)
 {
- auto tmp = js;
+ nlohmann::json* aux = &js;
 
  for (size_t i = 0; i < settings.size(); i++)
  {
-  if (tmp.find(settings[i]) == tmp.end()) return false;
-  tmp = tmp[settings[i]];
+  if (aux->is_object() == false) return NULL;
+  auto it = aux->find(settings[i]);
+  if (it == aux->end()) return NULL;
+  aux = &(*it);
  }
- return true;
+ return aux;
+}
+
+static bool isDefined(nlohmann::json& js, const std::vector<std::string>& settings)
+{
+ return findValue(js, settings) != NULL;
 }
 
 static bool isDefined(nlohmann::json& js, std::string path)
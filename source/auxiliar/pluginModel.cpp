@@ -0,0 +1,23 @@
+#include "auxiliar/pluginModel.hpp"
+#include "auxiliar/logger.hpp"
+#include <dlfcn.h>
+
+korali::PluginModel::PluginModel(const std::string& libraryPath, const std::string& symbolName)
+{
+ _libraryPath = libraryPath;
+ _symbolName = symbolName;
+
+ _library = dlopen(_libraryPath.c_str(), RTLD_NOW | RTLD_LOCAL);
+ if (_library == nullptr) korali::logError("Could not load model library '%s': %s\n", _libraryPath.c_str(), dlerror());
+
+ _function = (void (*)(korali::Sample&)) dlsym(_library, _symbolName.c_str());
+ if (_function == nullptr) korali::logError("Could not find model function '%s' in '%s'. Make sure it is declared extern \"C\".\n", _symbolName.c_str(), _libraryPath.c_str());
+}
+
+// Each copy holds its own reference to the library, which is unloaded when the last one is destroyed
+korali::PluginModel::PluginModel(const PluginModel& other) : PluginModel(other._libraryPath, other._symbolName) { }
+
+korali::PluginModel::~PluginModel()
+{
+ dlclose(_library);
+}
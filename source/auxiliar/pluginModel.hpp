@@ -0,0 +1,32 @@
+#ifndef _KORALI_AUXILIARS_PLUGINMODEL_HPP_
+#define _KORALI_AUXILIARS_PLUGINMODEL_HPP_
+
+#include <string>
+
+namespace korali
+{
+
+class Sample;
+
+// Model compiled into a shared library, as a function with C linkage and signature void(korali::Sample&).
+// The library is loaded on construction, so that worker processes forked afterwards can call it directly.
+class PluginModel
+{
+ public:
+
+ PluginModel(const std::string& libraryPath, const std::string& symbolName);
+ PluginModel(const PluginModel& other);
+ ~PluginModel();
+
+ std::string _libraryPath;
+ std::string _symbolName;
+
+ void* _library;
+ void (*_function)(korali::Sample&);
+
+ void operator()(korali::Sample& sample) { _function(sample); }
+};
+
+}
+
+#endif
@@ -11,14 +11,66 @@
 #include <string>
 #include <vector>
 #include <functional>
+#include <map>
+#include <cstdint>
 #include "external/json/json.hpp"
 #include "pybind11/pybind11.h"
 #include "pybind11/stl.h"
 #include "experiment/sample/sample.hpp"
+#include "auxiliar/externalModel.hpp"
+#include "auxiliar/pluginModel.hpp"
 
 typedef void(*__fkfc)(korali::Sample&);
 typedef std::function<void(korali::Sample&)> __kfc;
 
+namespace korali
+{
+ // Stored functions, by a key identifying the callable they were created from. Storing the same callable twice
+ // returns the same function, so that worker processes forked earlier can still resolve it. Keys never refer
+ // to an address that could be reused by a different callable: models are identified by their definition,
+ // and Python callables are kept alive by the registry.
+ inline std::map<std::string, std::uint64_t>& getFunctionRegistry()
+ {
+  static std::map<std::string, std::uint64_t> registry;
+  return registry;
+ }
+
+ template <class T> std::uint64_t registerFunction(const std::string& key, const T& function)
+ {
+  auto& registry = getFunctionRegistry();
+  if (registry.find(key) == registry.end()) registry[key] = (std::uint64_t) new __kfc(function);
+  return registry[key];
+ }
+
+ inline std::string getFunctionKey(const korali::ExternalModel& model)
+ {
+  std::string key = "External Model";
+  for (const auto& argument : model._command) { key += '\0'; key += argument; }
+  return key;
+ }
+
+ inline std::string getFunctionKey(const korali::PluginModel& model)
+ {
+  return std::string("Plugin Model") + '\0' + model._libraryPath + '\0' + model._symbolName;
+ }
+
+ // Compiled functions stay at the same address for the lifetime of the program
+ inline std::string getFunctionKey(__fkfc function)
+ {
+  return "Function " + std::to_string((std::uintptr_t) function);
+ }
+
+ inline std::uint64_t registerPythonFunction(const pybind11::handle& callable)
+ {
+  // The references are never released (nor destroyed at exit, after the interpreter is finalized)
+  static auto references = new std::vector<pybind11::object>();
+
+  std::string key = "Python Function " + std::to_string((std::uintptr_t) callable.ptr());
+  if (getFunctionRegistry().find(key) == getFunctionRegistry().end()) references->push_back(pybind11::reinterpret_borrow<pybind11::object>(callable));
+  return registerFunction(key, callable.cast<__kfc>());
+ }
+}
+
 namespace nlohmann
 {
     template <>
@@ -47,9 +99,29 @@ namespace nlohmann
 
     inline void adl_serializer<__fkfc>::to_json(json& j, const __fkfc& obj)
     {
-        korali::Sample kk;
-        auto x = new __kfc(*obj);
-        j = (std::uint64_t) x;
+        j = korali::registerFunction(korali::getFunctionKey(obj), obj);
+    }
+
+    template <>
+    struct adl_serializer<korali::ExternalModel>
+    {
+        static void to_json(json& j, const korali::ExternalModel& obj);
+    };
+
+    inline void adl_serializer<korali::ExternalModel>::to_json(json& j, const korali::ExternalModel& obj)
+    {
+        j = korali::registerFunction(korali::getFunctionKey(obj), obj);
+    }
+
+    template <>
+    struct adl_serializer<korali::PluginModel>
+    {
+        static void to_json(json& j, const korali::PluginModel& obj);
+    };
+
+    inline void adl_serializer<korali::PluginModel>::to_json(json& j, const korali::PluginModel& obj)
+    {
+        j = korali::registerFunction(korali::getFunctionKey(obj), obj);
     }
 
     namespace detail
@@ -106,9 +178,19 @@ namespace nlohmann
             {
                 return nullptr;
             }
+            if (pybind11::isinstance<korali::ExternalModel>(obj))
+            {
+               auto model = obj.cast<korali::ExternalModel>();
+               return korali::registerFunction(korali::getFunctionKey(model), model);
+            }
+            if (pybind11::isinstance<korali::PluginModel>(obj))
+            {
+               auto model = obj.cast<korali::PluginModel>();
+               return korali::registerFunction(korali::getFunctionKey(model), model);
+            }
             if (pybind11::isinstance<pybind11::function>(obj))
             {
-               return (std::uint64_t) new __kfc(obj.cast<__kfc>());
+               return korali::registerPythonFunction(obj);
             }
             if (pybind11::isinstance<pybind11::bool_>(obj))
             {
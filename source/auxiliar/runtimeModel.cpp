@@ -0,0 +1,60 @@
+#include "auxiliar/runtimeModel.hpp"
+#include <algorithm>
+
+static bool isNumericVector(const nlohmann::json& js)
+{
+ if (js.is_array() == false) return false;
+ for (size_t i = 0; i < js.size(); i++) if (js[i].is_number() == false) return false;
+ return true;
+}
+
+korali::RuntimeModel::RuntimeModel()
+{
+ _observationCount = 0;
+ _meanRuntime = 0.0;
+}
+
+double korali::RuntimeModel::predict(const nlohmann::json& parameters)
+{
+ if (_observationCount == 0) return -1.0;
+ if (isNumericVector(parameters) == false || parameters.size() != _weights.size()) return _meanRuntime;
+
+ double prediction = _meanRuntime;
+ for (size_t i = 0; i < _weights.size(); i++) prediction += _weights[i] * (parameters[i].get<double>() - _parameterMeans[i]);
+
+ return std::max(prediction, 0.0);
+}
+
+void korali::RuntimeModel::update(const nlohmann::json& parameters, double runtime)
+{
+ bool hasParameters = isNumericVector(parameters);
+ size_t parameterCount = hasParameters ? parameters.size() : 0;
+
+ if (_observationCount == 0 || parameterCount != _weights.size())
+ {
+  _weights.assign(parameterCount, 0.0);
+  _parameterMeans.assign(parameterCount, 0.0);
+  for (size_t i = 0; i < parameterCount; i++) _parameterMeans[i] = parameters[i];
+  _meanRuntime = runtime;
+  _observationCount = 1;
+  return;
+ }
+
+ double prediction = _meanRuntime;
+ double norm = 0.0;
+ for (size_t i = 0; i < parameterCount; i++)
+ {
+  double x = parameters[i].get<double>() - _parameterMeans[i];
+  prediction += _weights[i] * x;
+  norm += x*x;
+ }
+
+ // Normalized LMS step on the centered parameters
+ double error = runtime - prediction;
+ if (norm > 0.0) for (size_t i = 0; i < parameterCount; i++)
+  _weights[i] += 0.5 * error * (parameters[i].get<double>() - _parameterMeans[i]) / norm;
+
+ _observationCount++;
+ _meanRuntime += (runtime - _meanRuntime) / _observationCount;
+ for (size_t i = 0; i < parameterCount; i++) _parameterMeans[i] += (parameters[i].get<double>() - _parameterMeans[i]) / _observationCount;
+}
@@ -0,0 +1,29 @@
+#ifndef _KORALI_AUXILIARS_RUNTIMEMODEL_HPP_
+#define _KORALI_AUXILIARS_RUNTIMEMODEL_HPP_
+
+#include "external/json/json.hpp"
+#include <vector>
+
+namespace korali
+{
+
+// Online linear model of a sample's runtime as a function of its parameters, trained with normalized least mean squares
+class RuntimeModel
+{
+ public:
+
+ RuntimeModel();
+
+ size_t _observationCount;
+ double _meanRuntime;
+ std::vector<double> _parameterMeans;
+ std::vector<double> _weights;
+
+ // Returns -1.0 if there are no observations yet
+ double predict(const nlohmann::json& parameters);
+ void update(const nlohmann::json& parameters, double runtime);
+};
+
+}
+
+#endif
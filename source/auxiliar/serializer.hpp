@@ -0,0 +1,84 @@
+#ifndef _KORALI_AUXILIARS_SERIALIZER_HPP_
+#define _KORALI_AUXILIARS_SERIALIZER_HPP_
+
+#include "auxiliar/logger.hpp"
+#include <string>
+#include <vector>
+#include <cstring>
+#include <cstdint>
+#include <type_traits>
+
+namespace korali
+{
+
+// Binary encoding of module settings, used for checkpoints. Values are stored in native byte order,
+// and vectors and strings are prefixed by their size, so a buffer is only meant to be read back by the same build.
+
+template <typename T, typename std::enable_if<std::is_arithmetic<T>::value, int>::type = 0>
+void serializeValue(std::string& buffer, const T& value)
+{
+ buffer.append((const char*) &value, sizeof(T));
+}
+
+template <typename T, typename std::enable_if<std::is_arithmetic<T>::value, int>::type = 0>
+void deserializeValue(const std::string& buffer, size_t& pos, T& value)
+{
+ if (pos + sizeof(T) > buffer.size()) korali::logError("Binary state is shorter than expected.\n");
+ memcpy(&value, buffer.data() + pos, sizeof(T));
+ pos += sizeof(T);
+}
+
+inline void serializeValue(std::string& buffer, const std::string& value)
+{
+ serializeValue(buffer, value.size());
+ buffer += value;
+}
+
+inline void deserializeValue(const std::string& buffer, size_t& pos, std::string& value)
+{
+ size_t size;
+ deserializeValue(buffer, pos, size);
+ if (pos + size > buffer.size()) korali::logError("Binary state is shorter than expected.\n");
+ value.assign(buffer, pos, size);
+ pos += size;
+}
+
+// Vectors of arithmetic types are copied as a single block
+template <typename T, typename std::enable_if<std::is_arithmetic<T>::value, int>::type = 0>
+void serializeValue(std::string& buffer, const std::vector<T>& values)
+{
+ serializeValue(buffer, values.size());
+ buffer.append((const char*) values.data(), values.size()*sizeof(T));
+}
+
+template <typename T, typename std::enable_if<std::is_arithmetic<T>::value, int>::type = 0>
+void deserializeValue(const std::string& buffer, size_t& pos, std::vector<T>& values)
+{
+ size_t size;
+ deserializeValue(buffer, pos, size);
+ if (pos + size*sizeof(T) > buffer.size()) korali::logError("Binary state is shorter than expected.\n");
+ values.resize(size);
+ memcpy(values.data(), buffer.data() + pos, size*sizeof(T));
+ pos += size*sizeof(T);
+}
+
+template <typename T, typename std::enable_if<!std::is_arithmetic<T>::value, int>::type = 0>
+void serializeValue(std::string& buffer, const std::vector<T>& values)
+{
+ serializeValue(buffer, values.size());
+ for (const auto& value : values) serializeValue(buffer, value);
+}
+
+template <typename T, typename std::enable_if<!std::is_arithmetic<T>::value, int>::type = 0>
+void deserializeValue(const std::string& buffer, size_t& pos, std::vector<T>& values)
+{
+ size_t size;
+ deserializeValue(buffer, pos, size);
+ if (size > buffer.size() - pos) korali::logError("Binary state is shorter than expected.\n");
+ values.resize(size);
+ for (auto& value : values) deserializeValue(buffer, pos, value);
+}
+
+}
+
+#endif
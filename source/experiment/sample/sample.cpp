@@ -0,0 +1,71 @@
+#include "experiment/sample/sample.hpp"
+#include "auxiliar/math.hpp"
+
+static const char* _fieldNames[] = { "Parameters", "Evaluation", "logPrior", "logLikelihood", "logPosterior", "Gradient", "Constraint Evaluations" };
+static const size_t _fieldCount = 7;
+
+static const char* getFieldName(unsigned int field)
+{
+ for (size_t i = 0; i < _fieldCount; i++) if (field == (1u << i)) return _fieldNames[i];
+ return "";
+}
+
+unsigned int korali::Sample::getField(const std::string& key)
+{
+ for (size_t i = 0; i < _fieldCount; i++) if (key == _fieldNames[i]) return 1u << i;
+ return 0;
+}
+
+void korali::Sample::loadField(unsigned int field)
+{
+ if (_self->_typedFields & field) return;
+
+ auto& js = _self->_js.getJson();
+ auto it = js.find(getFieldName(field));
+ if (it == js.end()) korali::logError("Sample does not contain the field '%s'.\n", getFieldName(field));
+
+ // Non-finite values are serialized as null, which stands for -Infinity in evaluations
+ bool isVectorField = field == parametersField || field == gradientField || field == constraintEvaluationsField;
+ if (isVectorField == false && it->is_number() == false && it->is_null() == false)
+  korali::logError("Sample field '%s' must be a number, but it contains: %s\n", getFieldName(field), it->dump().c_str());
+
+ double value = it->is_null() ? -korali::Inf : 0.0;
+ if (it->is_number()) value = it->get<double>();
+
+ switch (field)
+ {
+  case parametersField: _self->_parameters = it->get<std::vector<double>>(); break;
+  case evaluationField: _self->_evaluation = value; break;
+  case logPriorField: _self->_logPrior = value; break;
+  case logLikelihoodField: _self->_logLikelihood = value; break;
+  case logPosteriorField: _self->_logPosterior = value; break;
+  case gradientField: _self->_gradient = it->get<std::vector<double>>(); break;
+  case constraintEvaluationsField: _self->_constraintEvaluations = it->get<std::vector<double>>(); break;
+ }
+
+ js.erase(it);
+ _self->_typedFields |= field;
+}
+
+void korali::Sample::setField(unsigned int field)
+{
+ if ((_self->_typedFields & field) == 0) _self->_js.getJson().erase(getFieldName(field));
+ _self->_typedFields |= field;
+}
+
+void korali::Sample::storeFields(unsigned int fields)
+{
+ fields &= _self->_typedFields;
+ if (fields == 0) return;
+
+ auto& js = _self->_js.getJson();
+ if (fields & parametersField) js["Parameters"] = _self->_parameters;
+ if (fields & evaluationField) js["Evaluation"] = _self->_evaluation;
+ if (fields & logPriorField) js["logPrior"] = _self->_logPrior;
+ if (fields & logLikelihoodField) js["logLikelihood"] = _self->_logLikelihood;
+ if (fields & logPosteriorField) js["logPosterior"] = _self->_logPosterior;
+ if (fields & gradientField) js["Gradient"] = _self->_gradient;
+ if (fields & constraintEvaluationsField) js["Constraint Evaluations"] = _self->_constraintEvaluations;
+
+ _self->_typedFields &= ~fields;
+}
@@ -0,0 +1,171 @@
+#ifndef __KORALI_SAMPLE_HPP_
+#define __KORALI_SAMPLE_HPP_
+
+#include "auxiliar/koraliJson.hpp"
+#include "auxiliar/logger.hpp"
+#include "external/libco/libco.h"
+#include "pybind11/numpy.h"
+#include <string>
+#include <vector>
+#include <map>
+#include <set>
+#include <memory>
+
+#undef _POSIX_C_SOURCE
+#undef _XOPEN_SOURCE
+
+namespace korali
+{
+
+enum class SampleState { uninitialized, initialized, running, waiting, finished };
+
+class Sample {
+
+ public:
+
+ Sample* _self;
+ SampleState _state;
+ cothread_t _sampleThread;
+
+ // Runtime predicted by the conduit when the sample started, -1.0 if unknown
+ double _predictedRuntime;
+
+ // Set when the sample was cancelled, so that its coroutine returns as soon as it is resumed
+ bool _isCancelled;
+
+ // JSON-based configuration
+ korali::KoraliJson _js;
+
+ // Typed fields, used by solvers and problems instead of JSON lookups. A field set in _typedFields holds its value in
+ // typed form and is absent from the JSON. It is moved into the JSON whenever its key is accessed through it.
+ enum : unsigned int
+ {
+  parametersField = 1,
+  evaluationField = 2,
+  logPriorField = 4,
+  logLikelihoodField = 8,
+  logPosteriorField = 16,
+  gradientField = 32,
+  constraintEvaluationsField = 64,
+  allFields = 127
+ };
+
+ unsigned int _typedFields;
+ std::vector<double> _parameters;
+ double _evaluation;
+ double _logPrior;
+ double _logLikelihood;
+ double _logPosterior;
+ std::vector<double> _gradient;
+ std::vector<double> _constraintEvaluations;
+
+ // Contiguous numeric arrays, shared with Python models as NumPy arrays without per-element conversion.
+ // Output arrays are stored into the sample's JSON once its model returns.
+ std::map<std::string, std::shared_ptr<std::vector<double>>> _arrays;
+ std::set<std::string> _outputArrays;
+
+ Sample()
+ {
+  _self = this;
+  _state = SampleState::uninitialized;
+  _predictedRuntime = -1.0;
+  _isCancelled = false;
+  _typedFields = 0;
+  _evaluation = 0.0;
+  _logPrior = 0.0;
+  _logLikelihood = 0.0;
+  _logPosterior = 0.0;
+  _js.getJson()["Sample Id"] = 0;
+ }
+
+ // Execution Control Functions
+ void start();
+ void resume();
+ void yield();
+ // Models read and write the sample's JSON, so typed fields are stored before running them
+ void run(std::uint64_t funcPtr) { storeFields(); (*reinterpret_cast<std::function<void(korali::Sample&)>*>(funcPtr))(*this); storeArrays(); }
+
+ // Typed Field Functions
+ static unsigned int getField(const std::string& key);
+ void loadField(unsigned int field);
+ void setField(unsigned int field);
+ void storeFields(unsigned int fields = allFields);
+
+ const std::vector<double>& getParameters() { loadField(parametersField); return _self->_parameters; }
+ double getEvaluation() { loadField(evaluationField); return _self->_evaluation; }
+ double getLogPrior() { loadField(logPriorField); return _self->_logPrior; }
+ double getLogLikelihood() { loadField(logLikelihoodField); return _self->_logLikelihood; }
+ double getLogPosterior() { loadField(logPosteriorField); return _self->_logPosterior; }
+ const std::vector<double>& getGradient() { loadField(gradientField); return _self->_gradient; }
+ const std::vector<double>& getConstraintEvaluations() { loadField(constraintEvaluationsField); return _self->_constraintEvaluations; }
+
+ void setParameters(const std::vector<double>& parameters) { _self->_parameters = parameters; setField(parametersField); }
+ void setEvaluation(double evaluation) { _self->_evaluation = evaluation; setField(evaluationField); }
+ void setLogPrior(double logPrior) { _self->_logPrior = logPrior; setField(logPriorField); }
+ void setLogLikelihood(double logLikelihood) { _self->_logLikelihood = logLikelihood; setField(logLikelihoodField); }
+ void setLogPosterior(double logPosterior) { _self->_logPosterior = logPosterior; setField(logPosteriorField); }
+ void setGradient(const std::vector<double>& gradient) { _self->_gradient = gradient; setField(gradientField); }
+ void setConstraintEvaluations(const std::vector<double>& constraintEvaluations) { _self->_constraintEvaluations = constraintEvaluations; setField(constraintEvaluationsField); }
+
+ // Array Access Functions
+ std::vector<double>& getArray(const std::string& key)
+ {
+  auto array = _self->_arrays.find(key);
+  if (array != _self->_arrays.end()) return *array->second;
+
+  if (contains(key) == false) korali::logError("Sample does not contain the array '%s'.\n", key.c_str());
+  auto& values = _self->_arrays[key];
+  values = std::make_shared<std::vector<double>>((*_self)[key].get<std::vector<double>>());
+  return *values;
+ }
+
+ // A new buffer is allocated each time, so arrays handed out earlier for the same key are not invalidated
+ std::vector<double>& allocateArray(const std::string& key, size_t size)
+ {
+  auto& values = _self->_arrays[key];
+  values = std::make_shared<std::vector<double>>(size, 0.0);
+  _self->_outputArrays.insert(key);
+  return *values;
+ }
+
+ void storeArrays()
+ {
+  for (const auto& key : _self->_outputArrays) (*_self)[key] = *_self->_arrays[key];
+  _self->_arrays.clear();
+  _self->_outputArrays.clear();
+ }
+
+ // The NumPy arrays share ownership of their buffer, so they remain valid if the model keeps them after returning.
+ // Writes made to an output array after its model returned are not stored into the sample.
+ pybind11::array_t<double> getNumpyArray(const std::string& key)
+ {
+  getArray(key);
+  return toNumpyArray(_self->_arrays[key]);
+ }
+
+ pybind11::array_t<double> allocateNumpyArray(const std::string& key, size_t size)
+ {
+  allocateArray(key, size);
+  return toNumpyArray(_self->_arrays[key]);
+ }
+
+ static pybind11::array_t<double> toNumpyArray(const std::shared_ptr<std::vector<double>>& values)
+ {
+  auto owner = new std::shared_ptr<std::vector<double>>(values);
+  pybind11::capsule base(owner, [](void* pointer) { delete reinterpret_cast<std::shared_ptr<std::vector<double>>*>(pointer); });
+  return pybind11::array_t<double>(values->size(), values->data(), base);
+ }
+
+ bool contains(const std::string& key) { return (_self->_typedFields & getField(key)) || _self->_js.contains(key); }
+
+ nlohmann::json& operator[](const std::string& key) { if (_self->_typedFields) storeFields(getField(key)); return _self->_js[key]; }
+ nlohmann::json& operator[](const unsigned long int& key) { return _self->_js[key]; }
+
+ pybind11::object getItem(pybind11::object key) { if (_self->_typedFields && pybind11::isinstance<pybind11::str>(key)) storeFields(getField(key.cast<std::string>())); return _self->_js.getItem(key); }
+ void setItem(pybind11::object key, pybind11::object val) { if (_self->_typedFields && pybind11::isinstance<pybind11::str>(key)) storeFields(getField(key.cast<std::string>())); _self->_js.setItem(key, val); }
+
+};
+
+}
+
+#endif // __KORALI_SAMPLE_HPP_
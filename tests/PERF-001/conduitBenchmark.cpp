@@ -0,0 +1,120 @@
+#include "korali.hpp"
+#include <sys/resource.h>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+
+// Measures Korali's own per-sample overhead by running a model that does no work
+
+size_t resultSize;
+
+void nullModel(korali::Sample& sample)
+{
+ sample["Evaluation"] = 0.0;
+ if (resultSize > 0) sample["Result"] = std::vector<double>(resultSize, 0.0);
+}
+
+double getCPUTime()
+{
+ struct rusage usage;
+ getrusage(RUSAGE_SELF, &usage);
+ return usage.ru_utime.tv_sec + usage.ru_utime.tv_usec * 1e-6 + usage.ru_stime.tv_sec + usage.ru_stime.tv_usec * 1e-6;
+}
+
+double getPercentile(std::vector<double> values, double percentile)
+{
+ if (values.empty()) return 0.0;
+ std::sort(values.begin(), values.end());
+ size_t index = std::ceil(percentile * values.size());
+ return values[index > 0 ? index-1 : 0];
+}
+
+int runBenchmark(std::string conduit, size_t jobs, size_t dimension, size_t sampleCount, std::string outputFile)
+{
+ auto e = korali::Experiment();
+
+ e["Problem"]["Type"] = "Execution/Model";
+ e["Problem"]["Execution Model"] = &nullModel;
+
+ e["Solver"]["Type"] = "Executor";
+
+ for (size_t i = 0; i < dimension; i++)
+ {
+  e["Variables"][i]["Name"] = "X" + std::to_string(i);
+  e["Variables"][i]["Loaded Values"] = std::vector<double>(sampleCount, 0.5);
+ }
+
+ e["Console"]["Verbosity"] = "Silent";
+ e["Results"]["Enabled"] = false;
+
+ auto k = korali::Engine();
+
+ k["Conduit"]["Type"] = conduit;
+ if (conduit == "Concurrent") k["Conduit"]["Concurrent Jobs"] = jobs;
+ if (conduit == "Distributed") k["Conduit"]["Workers Per Team"] = 1;
+
+ double cpuTime0 = getCPUTime();
+ auto t0 = std::chrono::high_resolution_clock::now();
+
+ k.run(e);
+
+ auto t1 = std::chrono::high_resolution_clock::now();
+ double cpuTime1 = getCPUTime();
+
+ if (korali::_conduit->isRoot() == false) return 0;
+
+ // Latency is the time between dispatching a sample and receiving its result
+ std::vector<double> latencies;
+ for (auto& timeline : korali::__profiler["Timelines"])
+  for (auto& entry : timeline)
+   latencies.push_back(entry["End Time"].get<double>() - entry["Start Time"].get<double>());
+
+ double elapsedTime = std::chrono::duration<double>(t1-t0).count();
+
+ auto js = nlohmann::json();
+ js["Conduit"] = conduit;
+ js["Jobs"] = jobs;
+ js["Dimension"] = dimension;
+ js["Result Size"] = resultSize;
+ js["Sample Count"] = sampleCount;
+ js["Elapsed Time"] = elapsedTime;
+ js["Samples Per Second"] = sampleCount / elapsedTime;
+ js["Latency P50"] = getPercentile(latencies, 0.50);
+ js["Latency P99"] = getPercentile(latencies, 0.99);
+ js["Root CPU Usage"] = (cpuTime1 - cpuTime0) / elapsedTime;
+
+ FILE* fid = fopen(outputFile.c_str(), "a");
+ if (fid == NULL) { printf("Could not open output file: %s\n", outputFile.c_str()); return -1; }
+ fprintf(fid, "%s\n", js.dump().c_str());
+ fclose(fid);
+
+ return 0;
+}
+
+int main(int argc, char* argv[])
+{
+ if (argc != 7)
+ {
+  printf("Usage: %s <Conduit> <Jobs> <Dimension> <Result Size> <Sample Count> <Output File>\n", argv[0]);
+  return -1;
+ }
+
+ std::string conduit = argv[1];
+ size_t jobs = atoi(argv[2]);
+ size_t dimension = atoi(argv[3]);
+ resultSize = atoi(argv[4]);
+ size_t sampleCount = atoi(argv[5]);
+ std::string outputFile = argv[6];
+
+ #ifdef _KORALI_USE_MPI
+ if (conduit == "Distributed") MPI_Init(&argc, &argv);
+ #endif
+
+ int result = runBenchmark(conduit, jobs, dimension, sampleCount, outputFile);
+
+ #ifdef _KORALI_USE_MPI
+ if (conduit == "Distributed") MPI_Finalize();
+ #endif
+
+ return result;
+}
@@ -0,0 +1,76 @@
+#!/bin/bash
+
+source ../functions.sh
+
+# Results are appended to conduitBenchmark.json. The sample count and the maximum
+# number of jobs can be increased through BENCHMARK_SAMPLES and BENCHMARK_MAX_JOBS.
+
+sampleCount=${BENCHMARK_SAMPLES:-1000}
+maxJobs=${BENCHMARK_MAX_JOBS:-4}
+dimensions="1 100"
+resultSizes="0 1000"
+outputFile=$PWD/conduitBenchmark.jsonl
+
+archString=`uname -a`
+if [[ $archString == *"Darwin"* ]]; then
+  echo "Skipping C++ tests on Darwin"
+  exit 0
+fi
+
+############# STEP 1 ##############
+
+logEcho "[Korali] Compiling conduitBenchmark..."
+make clean >> $logFile 2>&1
+check_result
+
+make -j >> $logFile 2>&1
+check_result
+
+rm -f $outputFile
+
+############# STEP 2 ##############
+
+for dimension in $dimensions; do
+for resultSize in $resultSizes; do
+
+ logEcho "[Korali] Running Sequential (Dimension: $dimension, Result Size: $resultSize)..."
+ ./conduitBenchmark Sequential 1 $dimension $resultSize $sampleCount $outputFile >> $logFile 2>&1
+ check_result
+
+ for (( jobs=1; jobs<=$maxJobs; jobs*=2 )); do
+  logEcho "[Korali] Running Concurrent with $jobs jobs (Dimension: $dimension, Result Size: $resultSize)..."
+  ./conduitBenchmark Concurrent $jobs $dimension $resultSize $sampleCount $outputFile >> $logFile 2>&1
+  check_result
+ done
+
+done
+done
+
+############# STEP 3 ##############
+
+python3 -m korali.cxx --cflags | grep -q _KORALI_USE_MPI
+hasMPI=$?
+
+if [ $hasMPI -eq 0 ] && command -v mpirun > /dev/null; then
+
+for dimension in $dimensions; do
+for resultSize in $resultSizes; do
+ for (( jobs=1; jobs<=$maxJobs; jobs*=2 )); do
+  logEcho "[Korali] Running Distributed with $jobs jobs (Dimension: $dimension, Result Size: $resultSize)..."
+  mpirun -n $((jobs+1)) ./conduitBenchmark Distributed $jobs $dimension $resultSize $sampleCount $outputFile >> $logFile 2>&1
+  check_result
+ done
+done
+done
+
+else
+ logEcho "[Korali] Skipping Distributed, Korali was not installed with MPI support."
+fi
+
+############# STEP 4 ##############
+
+python3 -c "import json; print(json.dumps([ json.loads(line) for line in open('$outputFile') ], indent=1))" > conduitBenchmark.json
+check_result
+
+rm -f $outputFile
+logEcho "[Korali] Results saved to conduitBenchmark.json"
@@ -0,0 +1,86 @@
+#include "korali.hpp"
+#include "solver/optimizer/CMAES/CMAES.hpp"
+#include <chrono>
+#include <cmath>
+
+// Measures CMAES's own per-generation overhead by optimizing a function that costs almost nothing to evaluate
+
+void sphere(korali::Sample& sample)
+{
+ const std::vector<double>& x = sample.getParameters();
+
+ double sum = 0.0;
+ for (size_t i = 0; i < x.size(); i++) sum += x[i]*x[i];
+
+ sample.setEvaluation(-sum);
+}
+
+int runBenchmark(size_t dimension, std::string eigensystemSolver, size_t updateFrequency, size_t generations, std::string outputFile)
+{
+ auto e = korali::Experiment();
+
+ e["Problem"]["Type"] = "Evaluation/Direct/Basic";
+ e["Problem"]["Objective"] = "Maximize";
+ e["Problem"]["Objective Function"] = &sphere;
+
+ for (size_t i = 0; i < dimension; i++)
+ {
+  e["Variables"][i]["Name"] = "X" + std::to_string(i);
+  e["Variables"][i]["Lower Bound"] = -10.0;
+  e["Variables"][i]["Upper Bound"] = +10.0;
+ }
+
+ e["Solver"]["Type"] = "Optimizer/CMAES";
+ e["Solver"]["Population Size"] = 4 + (size_t) std::floor(3*std::log(dimension));
+ e["Solver"]["Eigensystem Solver"] = eigensystemSolver;
+ e["Solver"]["Eigensystem Update Frequency"] = updateFrequency;
+ e["Solver"]["Termination Criteria"]["Max Generations"] = generations;
+
+ e["Console"]["Verbosity"] = "Silent";
+ e["Results"]["Enabled"] = false;
+
+ auto k = korali::Engine();
+
+ auto t0 = std::chrono::high_resolution_clock::now();
+
+ k.run(e);
+
+ auto t1 = std::chrono::high_resolution_clock::now();
+
+ double elapsedTime = std::chrono::duration<double>(t1-t0).count();
+ size_t generationCount = e._currentGeneration;
+ auto solver = dynamic_cast<korali::solver::optimizer::CMAES*>(e._solver);
+
+ auto js = nlohmann::json();
+ js["Dimension"] = dimension;
+ js["Population Size"] = solver->_populationSize;
+ js["Eigensystem Solver"] = eigensystemSolver;
+ js["Eigensystem Update Frequency"] = solver->_covarianceEigenvalueEvaluationFrequency;
+ js["Generations"] = generationCount;
+ js["Elapsed Time"] = elapsedTime;
+ js["Seconds Per Generation"] = elapsedTime / generationCount;
+
+ FILE* fid = fopen(outputFile.c_str(), "a");
+ if (fid == NULL) { printf("Could not open output file: %s\n", outputFile.c_str()); return -1; }
+ fprintf(fid, "%s\n", js.dump().c_str());
+ fclose(fid);
+
+ return 0;
+}
+
+int main(int argc, char* argv[])
+{
+ if (argc != 6)
+ {
+  printf("Usage: %s <Dimension> <Eigensystem Solver> <Eigensystem Update Frequency> <Generations> <Output File>\n", argv[0]);
+  return -1;
+ }
+
+ size_t dimension = atoi(argv[1]);
+ std::string eigensystemSolver = argv[2];
+ size_t updateFrequency = atoi(argv[3]);
+ size_t generations = atoi(argv[4]);
+ std::string outputFile = argv[5];
+
+ return runBenchmark(dimension, eigensystemSolver, updateFrequency, generations, outputFile);
+}
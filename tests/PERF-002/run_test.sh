@@ -0,0 +1,51 @@
+#!/bin/bash
+
+source ../functions.sh
+
+# Results are appended to cmaesBenchmark.json. The number of generations and the dimensions
+# can be changed through BENCHMARK_GENERATIONS and BENCHMARK_DIMENSIONS.
+
+generations=${BENCHMARK_GENERATIONS:-20}
+dimensions=${BENCHMARK_DIMENSIONS:-"2 4 8 16 100 500 1000"}
+outputFile=$PWD/cmaesBenchmark.jsonl
+
+archString=`uname -a`
+if [[ $archString == *"Darwin"* ]]; then
+  echo "Skipping C++ tests on Darwin"
+  exit 0
+fi
+
+############# STEP 1 ##############
+
+logEcho "[Korali] Compiling cmaesBenchmark..."
+make clean >> $logFile 2>&1
+check_result
+
+make -j >> $logFile 2>&1
+check_result
+
+rm -f $outputFile
+
+############# STEP 2 ##############
+
+for dimension in $dimensions; do
+for solver in GSL Eigen; do
+
+ logEcho "[Korali] Running $solver eigensolver, every generation (Dimension: $dimension)..."
+ ./cmaesBenchmark $dimension $solver 1 $generations $outputFile >> $logFile 2>&1
+ check_result
+
+ logEcho "[Korali] Running $solver eigensolver, lazy updates (Dimension: $dimension)..."
+ ./cmaesBenchmark $dimension $solver 0 $generations $outputFile >> $logFile 2>&1
+ check_result
+
+done
+done
+
+############# STEP 3 ##############
+
+python3 -c "import json; print(json.dumps([ json.loads(line) for line in open('$outputFile') ], indent=1))" > cmaesBenchmark.json
+check_result
+
+rm -f $outputFile
+logEcho "[Korali] Results saved to cmaesBenchmark.json"
@@ -0,0 +1,91 @@
+#include "korali.hpp"
+#include "solver/optimizer/LMCMAES/LMCMAES.hpp"
+#include <chrono>
+#include <cmath>
+
+// Measures LMCMAES's per-generation overhead for large problems, with the history stored in double or single precision
+
+void ellipsoid(korali::Sample& sample)
+{
+ const std::vector<double>& x = sample.getParameters();
+
+ double sum = 0.0;
+ for (size_t i = 0; i < x.size(); i++) sum += std::pow(1e3, double(i)/double(x.size()-1)) * x[i]*x[i];
+
+ sample.setEvaluation(-sum);
+}
+
+int runBenchmark(size_t dimension, std::string historyPrecision, size_t generations, std::string outputFile)
+{
+ auto e = korali::Experiment();
+
+ e["Problem"]["Type"] = "Evaluation/Direct/Basic";
+ e["Problem"]["Objective"] = "Maximize";
+ e["Problem"]["Objective Function"] = &ellipsoid;
+
+ for (size_t i = 0; i < dimension; i++)
+ {
+  e["Variables"][i]["Name"] = "X" + std::to_string(i);
+  e["Variables"][i]["Lower Bound"] = -10.0;
+  e["Variables"][i]["Upper Bound"] = +10.0;
+  e["Variables"][i]["Initial Mean"] = 1.0;
+  e["Variables"][i]["Initial Standard Deviation"] = 1.0;
+ }
+
+ // The subset size of the original LM-CMA, since the default sqrt(N) does not fit in memory for the largest problems
+ size_t logDimension = std::floor(3*std::log(dimension));
+
+ e["Solver"]["Type"] = "Optimizer/LMCMAES";
+ e["Solver"]["Population Size"] = 4 + logDimension;
+ e["Solver"]["Subset Size"] = 4 + logDimension;
+ e["Solver"]["History Precision"] = historyPrecision;
+ e["Solver"]["Termination Criteria"]["Max Generations"] = generations;
+
+ e["Console"]["Verbosity"] = "Silent";
+ e["Results"]["Enabled"] = false;
+
+ auto k = korali::Engine();
+
+ auto t0 = std::chrono::high_resolution_clock::now();
+
+ k.run(e);
+
+ auto t1 = std::chrono::high_resolution_clock::now();
+
+ double elapsedTime = std::chrono::duration<double>(t1-t0).count();
+ size_t generationCount = e._currentGeneration;
+ auto solver = dynamic_cast<korali::solver::optimizer::LMCMAES*>(e._solver);
+
+ auto js = nlohmann::json();
+ js["Dimension"] = dimension;
+ js["Population Size"] = solver->_populationSize;
+ js["Subset Size"] = solver->_subsetSize;
+ js["History Precision"] = historyPrecision;
+ js["Generations"] = generationCount;
+ js["Best Ever Value"] = solver->_bestEverValue;
+ js["Elapsed Time"] = elapsedTime;
+ js["Seconds Per Generation"] = elapsedTime / generationCount;
+
+ FILE* fid = fopen(outputFile.c_str(), "a");
+ if (fid == NULL) { printf("Could not open output file: %s\n", outputFile.c_str()); return -1; }
+ fprintf(fid, "%s\n", js.dump().c_str());
+ fclose(fid);
+
+ return 0;
+}
+
+int main(int argc, char* argv[])
+{
+ if (argc != 5)
+ {
+  printf("Usage: %s <Dimension> <History Precision> <Generations> <Output File>\n", argv[0]);
+  return -1;
+ }
+
+ size_t dimension = atoi(argv[1]);
+ std::string historyPrecision = argv[2];
+ size_t generations = atoi(argv[3]);
+ std::string outputFile = argv[4];
+
+ return runBenchmark(dimension, historyPrecision, generations, outputFile);
+}
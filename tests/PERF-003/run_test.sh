@@ -0,0 +1,47 @@
+#!/bin/bash
+
+source ../functions.sh
+
+# Results are appended to lmcmaesBenchmark.json. The number of generations and the dimensions
+# can be changed through BENCHMARK_GENERATIONS and BENCHMARK_DIMENSIONS (e.g. "100000 1000000").
+
+generations=${BENCHMARK_GENERATIONS:-10}
+dimensions=${BENCHMARK_DIMENSIONS:-"1000 10000 100000"}
+outputFile=$PWD/lmcmaesBenchmark.jsonl
+
+archString=`uname -a`
+if [[ $archString == *"Darwin"* ]]; then
+  echo "Skipping C++ tests on Darwin"
+  exit 0
+fi
+
+############# STEP 1 ##############
+
+logEcho "[Korali] Compiling lmcmaesBenchmark..."
+make clean >> $logFile 2>&1
+check_result
+
+make -j >> $logFile 2>&1
+check_result
+
+rm -f $outputFile
+
+############# STEP 2 ##############
+
+for dimension in $dimensions; do
+for precision in Double Single; do
+
+ logEcho "[Korali] Running LMCMAES, $precision precision history (Dimension: $dimension)..."
+ ./lmcmaesBenchmark $dimension $precision $generations $outputFile >> $logFile 2>&1
+ check_result
+
+done
+done
+
+############# STEP 3 ##############
+
+python3 -c "import json; print(json.dumps([ json.loads(line) for line in open('$outputFile') ], indent=1))" > lmcmaesBenchmark.json
+check_result
+
+rm -f $outputFile
+logEcho "[Korali] Results saved to lmcmaesBenchmark.json"
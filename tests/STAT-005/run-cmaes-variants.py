@@ -0,0 +1,64 @@
+#!/usr/bin/env python3
+import korali
+
+# Evaluations needed to reach f < 1e-8, averaged over several seeds
+
+N = 10
+target = 1e-8
+seeds = [ 1337, 4242, 0xC0FFEE, 777, 31415 ]
+
+def ellipsoid(s):
+  x = s["Parameters"]
+  s["Evaluation"] = -sum([ 1e6**(i/(N-1.0)) * x[i]**2 for i in range(N) ])
+
+def cigar(s):
+  x = s["Parameters"]
+  s["Evaluation"] = -(x[0]**2 + 1e6*sum([ x[i]**2 for i in range(1, N) ]))
+
+variants = {
+ "Standard":            (False, "Independent"),
+ "Active":              (True,  "Independent"),
+ "Mirrored":            (False, "Mirrored"),
+ "Orthogonal":          (False, "Orthogonal"),
+ "Active + Orthogonal": (True,  "Orthogonal")
+}
+
+def evaluationsToTarget(model, isActive, samplingStrategy, seed):
+  e = korali.Experiment()
+  e["Problem"]["Type"] = "Evaluation/Direct/Basic"
+  e["Problem"]["Objective"] = "Maximize"
+  e["Problem"]["Objective Function"] = model
+
+  for i in range(N):
+    e["Variables"][i]["Name"] = "X" + str(i)
+    e["Variables"][i]["Initial Mean"] = 3.0
+    e["Variables"][i]["Initial Standard Deviation"] = 2.0
+
+  e["Solver"]["Type"] = "Optimizer/CMAES"
+  e["Solver"]["Population Size"] = 10
+  e["Solver"]["Use Active Covariance Update"] = isActive
+  e["Solver"]["Sampling Strategy"] = samplingStrategy
+  e["Solver"]["Termination Criteria"]["Max Value"] = -target
+  e["Solver"]["Termination Criteria"]["Max Generations"] = 20000
+
+  e["Console"]["Verbosity"] = "Silent"
+  e["Results"]["Enabled"] = False
+  e["Random Seed"] = seed
+
+  k = korali.Engine()
+  k.run(e)
+
+  assert -e["Solver"]["Internal"]["Best Ever Value"] < target, "Target not reached"
+  return e["Solver"]["Internal"]["Model Evaluation Count"]
+
+for modelName, model in [ ("Ellipsoid", ellipsoid), ("Cigar", cigar) ]:
+  averages = {}
+  for name, (isActive, samplingStrategy) in variants.items():
+    counts = [ evaluationsToTarget(model, isActive, samplingStrategy, seed) for seed in seeds ]
+    averages[name] = sum(counts) / len(counts)
+
+  print(modelName + ":")
+  for name in variants:
+    print("  {0:20s} {1:8.0f} evaluations ({2:+.1f}% vs. Standard)".format(name, averages[name], 100.0 * (averages[name] / averages["Standard"] - 1.0)))
+
+  assert averages["Active"] < averages["Standard"]
@@ -0,0 +1,17 @@
+#!/bin/bash
+
+source ../functions.sh
+
+############# STEP 1 ##############
+
+logEcho "[Korali] Beginning STAT-005 test"
+logEcho "[Korali] evaluations to target of CMA-ES variants..."
+
+for file in run*.py
+do
+  logEcho "-------------------------------------"
+  logEcho " Running $file"
+  logEcho "-------------------------------------"
+  ./"$file" >> $logFile 2>&1
+  check_result
+done
@@ -0,0 +1,65 @@
+#!/usr/bin/env python3
+import korali
+import math
+
+# Adaptive MCMC on a correlated 2D Gaussian. Every candidate is the leader of the previous step plus the
+# proposal step, so the steps of the adapted chain must have the covariance of the chain
+
+rho = 0.9
+maxSamples = 20000
+nonAdaptionPeriod = 1000
+
+candidates = []
+
+def lgaussian2d(s):
+  x = s["Parameters"]
+  candidates.append([ x[0], x[1] ])
+  s["Evaluation"] = -0.5 * (x[0]**2 - 2.0*rho*x[0]*x[1] + x[1]**2) / (1.0 - rho**2)
+
+e = korali.Experiment()
+e["Problem"]["Type"] = "Evaluation/Direct/Basic"
+e["Problem"]["Objective Function"] = lgaussian2d
+
+for i in range(2):
+  e["Variables"][i]["Name"] = "X" + str(i)
+  e["Variables"][i]["Initial Mean"] = 0.0
+  e["Variables"][i]["Initial Standard Deviation"] = 1.0
+
+e["Solver"]["Type"]  = "Sampler/MCMC"
+e["Solver"]["Burn In"] = 0
+e["Solver"]["Leap"] = 1
+e["Solver"]["Rejection Levels"] = 1
+e["Solver"]["Use Adaptive Sampling"] = True
+e["Solver"]["Non Adaption Period"] = nonAdaptionPeriod
+e["Solver"]["Termination Criteria"]["Max Samples"] = maxSamples
+
+e["Console"]["Verbosity"] = "Silent"
+e["Results"]["Enabled"] = False
+e["Random Seed"] = 1337
+
+k = korali.Engine()
+k.run(e)
+
+# The database holds the leader after every step, the candidate of step t was proposed from the leader of step t-1
+database = e["Solver"]["Internal"]["Sample Database"]
+assert len(candidates) == maxSamples, "Expected one evaluation per step"
+
+steps = []
+for t in range(maxSamples//2, maxSamples):
+  steps.append([ candidates[t][d] - database[2*(t-1)+d] for d in range(2) ])
+
+n = len(steps)
+mean = [ sum([ s[d] for s in steps ]) / n for d in range(2) ]
+cov = [ [ sum([ (s[d] - mean[d]) * (s[f] - mean[f]) for s in steps ]) / (n - 1) for f in range(2) ] for d in range(2) ]
+stepCorrelation = cov[0][1] / math.sqrt(cov[0][0] * cov[1][1])
+
+chainCov = e["Solver"]["Internal"]["Chain Covariance"]
+chainCorrelation = chainCov[1] / math.sqrt(chainCov[0] * chainCov[3])
+
+print("Proposal Step Covariance: [[%f, %f], [%f, %f]], Correlation %f" % (cov[0][0], cov[0][1], cov[1][0], cov[1][1], stepCorrelation))
+print("Chain Covariance:         [[%f, %f], [%f, %f]], Correlation %f" % (chainCov[0], chainCov[1], chainCov[2], chainCov[3], chainCorrelation))
+
+assert abs(chainCorrelation - rho) < 0.05, "Chain Covariance not adapted to the target"
+assert abs(stepCorrelation - chainCorrelation) < 0.05, "Proposal steps are not correlated like the chain"
+for d in range(2):
+  assert abs(cov[d][d] / chainCov[3*d] - 1.0) < 0.1, "Proposal step variance differs from the chain variance"
@@ -0,0 +1,17 @@
+#!/bin/bash
+
+source ../functions.sh
+
+############# STEP 1 ##############
+
+logEcho "[Korali] Beginning STAT-006 test"
+logEcho "[Korali] proposal covariance of adaptive MCMC..."
+
+for file in run*.py
+do
+  logEcho "-------------------------------------"
+  logEcho " Running $file"
+  logEcho "-------------------------------------"
+  ./"$file" >> $logFile 2>&1
+  check_result
+done
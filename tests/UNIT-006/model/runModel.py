@@ -0,0 +1,12 @@
+#!/usr/bin/env python3
+import sys
+import subprocess
+
+def runModel(x):
+  argString = ['model/model.py']
+  v = x["Parameters"]
+  for i in v: argString.append(str(i))
+  retValue = subprocess.check_output(argString)
+  result = float(retValue.decode())
+  x["Evaluation"] = result
+
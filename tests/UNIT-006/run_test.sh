@@ -0,0 +1,26 @@
+#!/bin/bash
+
+source ../functions.sh
+
+############# Preparing Test ##############
+
+if [[ $MPICXX == "" ]]
+then
+ echo "[Korali] MPI not installed, skipping test."
+ exit 0
+fi
+
+############# STEP 1 ##############
+
+logEcho "[Korali] Running mpirun -n 3 ./hybrid.py 1..."
+mpirun -n 3 ./hybrid.py 1 >> $logFile
+check_result
+
+############# STEP 2 ##############
+
+logEcho "[Korali] Running mpirun -n 3 ./hybrid.py 4..."
+mpirun -n 3 ./hybrid.py 4 >> $logFile
+check_result
+
+rm -rf _korali_result >> $logFile 2>&1
+check_result
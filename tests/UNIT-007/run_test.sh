@@ -0,0 +1,24 @@
+#!/bin/bash
+
+source ../functions.sh
+
+############# STEP 1 ##############
+
+logEcho "[Korali] Running scheduling.py 1..."
+./scheduling.py 1 >> $logFile
+check_result
+
+############# STEP 2 ##############
+
+logEcho "[Korali] Running scheduling.py 4..."
+./scheduling.py 4 >> $logFile
+check_result
+
+############# STEP 3 ##############
+
+logEcho "[Korali] Running scheduling.py Sequential..."
+./scheduling.py Sequential >> $logFile
+check_result
+
+rm -rf _korali_result* >> $logFile 2>&1
+check_result
@@ -0,0 +1,47 @@
+#!/usr/bin/env python3
+import korali
+import sys
+sys.path.append("model")
+from runModel import *
+
+k = korali.Engine()
+
+if (len(sys.argv) != 2):
+ print('Error: this example requires the number of concurrent jobs, or "Sequential", passed as argument.\n')
+ exit(-1)
+
+eList = []
+
+for i in range(6):
+ e = korali.Experiment()
+
+ e["Problem"]["Type"] = "Evaluation/Direct/Basic";
+ e["Problem"]["Objective"] = "Maximize"
+ e["Problem"]["Objective Function"] = runModel
+
+ e["Solver"]["Type"] = "Optimizer/CMAES"
+ e["Solver"]["Population Size"] = 8 if i % 2 == 0 else 16
+ e["Solver"]["Termination Criteria"]["Max Generations"] = 10
+
+ e["Variables"][0]["Name"] = "X0"
+ e["Variables"][0]["Lower Bound"] = -32.0;
+ e["Variables"][0]["Upper Bound"] = +32.0;
+
+ e["Variables"][1]["Name"] = "X1"
+ e["Variables"][1]["Lower Bound"] = -32.0;
+ e["Variables"][1]["Upper Bound"] = +32.0;
+
+ e["Scheduling"]["Priority"] = i % 3
+ e["Scheduling"]["Max Workers"] = 2 if i % 2 == 1 else 0
+
+ e["Results"]["Path"] = "_korali_result" + str(i)
+ e["Random Seed"] = 0xC0FFEE
+ eList.append(e)
+
+if (sys.argv[1] == "Sequential"):
+ k["Conduit"]["Type"] = "Sequential"
+else:
+ k["Conduit"]["Type"] = "Concurrent"
+ k["Conduit"]["Concurrent Jobs"] = int(sys.argv[1])
+
+k.run(eList)
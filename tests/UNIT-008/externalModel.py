@@ -0,0 +1,34 @@
+#!/usr/bin/env python3
+import korali
+import sys
+
+k = korali.Engine()
+
+if (len(sys.argv) != 2):
+ print('Error: this example requires the number of concurrent jobs passed as numerical argument.\n')
+ exit(-1)
+
+e = korali.Experiment()
+
+e["Problem"]["Type"] = "Evaluation/Direct/Basic";
+e["Problem"]["Objective"] = "Maximize"
+e["Problem"]["Objective Function"] = korali.ExternalModel([ "model/persistentModel.py" ])
+
+e["Solver"]["Type"] = "Optimizer/CMAES"
+e["Solver"]["Population Size"] = 12
+e["Solver"]["Termination Criteria"]["Max Generations"] = 10
+
+for i in range(4):
+ e["Variables"][i]["Name"] = "X" + str(i)
+ e["Variables"][i]["Lower Bound"] = -32.0;
+ e["Variables"][i]["Upper Bound"] = +32.0;
+
+e["Random Seed"] = 0xC0FFEE
+
+jobs = int(sys.argv[1])
+if (jobs == 1): k["Conduit"]["Type"] = "Sequential"
+else:
+ k["Conduit"]["Type"] = "Concurrent"
+ k["Conduit"]["Concurrent Jobs"] = jobs
+
+k.run(e)
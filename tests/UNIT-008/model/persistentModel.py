@@ -0,0 +1,21 @@
+#!/usr/bin/env python3
+import math
+import sys
+import json
+
+a = 20.0
+b = 0.2
+c = 2.*math.pi
+
+# Evaluates one sample per input line: the parameter count, followed by the parameter values
+for line in sys.stdin:
+  values = line.split()
+  s1 = 0
+  s2 = 0
+  for i in range(1, len(values)):
+    val = float(values[i])
+    s1 += val*val
+    s2 += math.cos(c*val)
+
+  result = -a*math.exp(-b*math.sqrt(s1/4)) - math.exp(s2/4) + a + math.exp(1.)
+  print(json.dumps({ "Evaluation": -result }), flush=True)
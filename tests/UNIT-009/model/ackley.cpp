@@ -0,0 +1,22 @@
+#include "korali.hpp"
+#include <cmath>
+
+extern "C" void ackley(korali::Sample& sample)
+{
+ double a = 20.0;
+ double b = 0.2;
+ double c = 2.*M_PI;
+
+ auto& parameters = sample["Parameters"];
+ double s1 = 0.0;
+ double s2 = 0.0;
+ for (size_t i = 0; i < parameters.size(); i++)
+ {
+  double val = parameters[i];
+  s1 += val*val;
+  s2 += cos(c*val);
+ }
+
+ double result = -a*exp(-b*sqrt(s1/4)) - exp(s2/4) + a + exp(1.);
+ sample["Evaluation"] = -result;
+}
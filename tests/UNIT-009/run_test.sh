@@ -0,0 +1,24 @@
+#!/bin/bash
+
+source ../functions.sh
+
+############# STEP 1 ##############
+
+logEcho "[Korali] Compiling model plugin..."
+`python3 -m korali.cxx --compiler` -shared -fPIC `python3 -m korali.cxx --cflags` model/ackley.cpp -o model/libackley.so `python3 -m korali.cxx --libs` >> $logFile 2>&1
+check_result
+
+############# STEP 2 ##############
+
+logEcho "[Korali] Running pluginModel.py 1..."
+./pluginModel.py 1 >> $logFile
+check_result
+
+############# STEP 3 ##############
+
+logEcho "[Korali] Running pluginModel.py 4..."
+./pluginModel.py 4 >> $logFile
+check_result
+
+rm -rf _korali_result model/libackley.so >> $logFile 2>&1
+check_result
@@ -0,0 +1,48 @@
+#!/usr/bin/env python3
+import korali
+import numpy
+import sys
+
+# Arrays of the last evaluation, kept after the model returns
+keptArrays = []
+
+# Evaluating the function and its gradient on NumPy views of the sample's arrays
+def model(s):
+  x = s.getArray("Parameters")
+  gradient = s.allocateArray("Gradient", len(x))
+  numpy.negative(x, out=gradient)
+  s["Evaluation"] = -0.5*float(numpy.dot(x, x))
+  keptArrays[:] = [ x, gradient ]
+
+k = korali.Engine()
+
+if (len(sys.argv) != 2):
+ print('Error: this example requires the number of concurrent jobs passed as numerical argument.\n')
+ exit(-1)
+
+e = korali.Experiment()
+
+e["Problem"]["Type"] = "Evaluation/Direct/Gradient"
+e["Problem"]["Objective"] = "Maximize"
+e["Problem"]["Objective Function"] = model
+
+for i in range(100):
+  e["Variables"][i]["Name"] = "X" + str(i)
+  e["Variables"][i]["Initial Value"] = -10.0 + 0.2*i
+
+e["Solver"]["Type"] = "Optimizer/Rprop"
+e["Solver"]["Termination Criteria"]["Max Generations"] = 100
+
+jobs = int(sys.argv[1])
+if (jobs == 1): k["Conduit"]["Type"] = "Sequential"
+else:
+ k["Conduit"]["Type"] = "Concurrent"
+ k["Conduit"]["Concurrent Jobs"] = jobs
+
+k.run(e)
+
+# Kept arrays must still hold their values once their samples are gone
+if (jobs == 1):
+ x, gradient = keptArrays
+ assert len(x) == 100
+ assert numpy.array_equal(gradient, -x)
@@ -0,0 +1,18 @@
+#!/bin/bash
+
+source ../functions.sh
+
+############# STEP 1 ##############
+
+logEcho "[Korali] Running numpyArrays.py 1..."
+./numpyArrays.py 1 >> $logFile
+check_result
+
+############# STEP 2 ##############
+
+logEcho "[Korali] Running numpyArrays.py 4..."
+./numpyArrays.py 4 >> $logFile
+check_result
+
+rm -rf _korali_result >> $logFile 2>&1
+check_result
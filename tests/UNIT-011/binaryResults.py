@@ -0,0 +1,48 @@
+#!/usr/bin/env python3
+import os
+import sys
+sys.path.append('../../tutorials/b1-checkpoint-restart/model')
+from model import *
+import korali
+
+def createExperiment(maxGenerations):
+ e = korali.Experiment()
+
+ e["Problem"]["Type"] = "Evaluation/Direct/Basic"
+ e["Problem"]["Objective"] = "Maximize"
+ e["Problem"]["Objective Function"] = model
+
+ e["Solver"]["Type"] = "Optimizer/CMAES"
+ e["Solver"]["Population Size"] = 5
+ e["Solver"]["Termination Criteria"]["Max Generations"] = maxGenerations
+
+ e["Variables"][0]["Name"] = "X"
+ e["Variables"][0]["Lower Bound"] = -10.0
+ e["Variables"][0]["Upper Bound"] = +10.0
+
+ e["Results"]["Path"] = "_korali_result_binary"
+ e["Results"]["Format"] = "Binary"
+ e["Random Seed"] = 0xC0FFEE
+ return e
+
+# Running the first 5 generations. Only the first and last results are saved as JSON.
+k = korali.Engine()
+e = createExperiment(5)
+k.run(e)
+
+resultFiles = sorted(os.listdir("_korali_result_binary"))
+assert resultFiles == [ "gen00000000.json", "gen00000001.bin", "gen00000002.bin", "gen00000003.bin", "gen00000004.bin", "gen00000005.json" ], resultFiles
+
+# Simulating an interrupted run, which has to be resumed from the last binary result
+os.remove("_korali_result_binary/gen00000005.json")
+
+k = korali.Engine()
+e = createExperiment(5)
+assert e.loadState("_korali_result_binary")
+e["Problem"]["Objective Function"] = model
+e["Solver"]["Termination Criteria"]["Max Generations"] = 10
+k.run(e)
+
+assert e["Internal"]["Current Generation"] == 10, e["Internal"]["Current Generation"]
+assert os.path.isfile("_korali_result_binary/gen00000010.json")
+assert e["Solver"]["Internal"]["Best Ever Value"] > -1e-3, e["Solver"]["Internal"]["Best Ever Value"]
@@ -0,0 +1,13 @@
+#!/bin/bash
+
+source ../functions.sh
+
+############# STEP 1 ##############
+
+logEcho "[Korali] Running binaryResults.py..."
+rm -rf _korali_result_binary >> $logFile 2>&1
+./binaryResults.py >> $logFile
+check_result
+
+rm -rf _korali_result_binary >> $logFile 2>&1
+check_result
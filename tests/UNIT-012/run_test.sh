@@ -0,0 +1,12 @@
+#!/bin/bash
+
+source ../functions.sh
+
+############# STEP 1 ##############
+
+logEcho "[Korali] Running simulatedConduit.py..."
+./simulatedConduit.py >> $logFile
+check_result
+
+rm -f _simulated_*.json >> $logFile 2>&1
+check_result
@@ -0,0 +1,61 @@
+#!/usr/bin/env python3
+import json
+import korali
+
+def model(s):
+ x = s["Parameters"][0]
+ s["Evaluation"] = -0.5*x*x
+
+def runSimulation(workers, durationType, profilingPath):
+ k = korali.Engine()
+ e = korali.Experiment()
+
+ e["Problem"]["Type"] = "Evaluation/Direct/Basic"
+ e["Problem"]["Objective"] = "Maximize"
+ e["Problem"]["Objective Function"] = model
+
+ e["Solver"]["Type"] = "Optimizer/CMAES"
+ e["Solver"]["Population Size"] = 8
+ e["Solver"]["Termination Criteria"]["Max Generations"] = 5
+
+ e["Variables"][0]["Name"] = "X"
+ e["Variables"][0]["Lower Bound"] = -10.0
+ e["Variables"][0]["Upper Bound"] = +10.0
+
+ e["Results"]["Enabled"] = False
+ e["Random Seed"] = 0xC0FFEE
+
+ k["Conduit"]["Type"] = "Simulated"
+ k["Conduit"]["Workers"] = workers
+ k["Conduit"]["Sample Duration"]["Type"] = durationType
+ k["Conduit"]["Sample Duration"]["Mean"] = 2.0
+ k["Conduit"]["Sample Duration"]["Standard Deviation"] = 1.0
+ k["Conduit"]["Sample Duration"]["Trace Path"] = "_simulated_1.json"
+
+ k["Profiling"]["Detail"] = "Full"
+ k["Profiling"]["Path"] = profilingPath
+
+ k.run(e)
+
+ with open(profilingPath) as f: return json.load(f)
+
+# A single worker evaluates samples one after the other
+profile = runSimulation(1, "Constant", "_simulated_1.json")
+sampleCount = len(profile["Timelines"]["Worker 0"])
+generationCount = sampleCount // 8
+assert profile["Simulation"]["Virtual Time"] == 2.0 * sampleCount, profile["Simulation"]
+assert profile["Simulation"]["Worker Utilization"] == 1.0, profile["Simulation"]
+
+# With one worker per sample, each generation takes a single sample duration
+profile = runSimulation(8, "Constant", "_simulated_8.json")
+assert profile["Simulation"]["Virtual Time"] == 2.0 * generationCount, profile["Simulation"]
+assert profile["Simulation"]["Worker Utilization"] == 1.0, profile["Simulation"]
+
+# Replaying the first run's durations on 4 workers, each generation takes two sample durations
+profile = runSimulation(4, "Trace", "_simulated_4.json")
+assert profile["Simulation"]["Virtual Time"] == 4.0 * generationCount, profile["Simulation"]
+
+# Random durations with many more workers than samples
+profile = runSimulation(10000, "Log Normal", "_simulated_10000.json")
+assert profile["Simulation"]["Virtual Time"] > 0.0, profile["Simulation"]
+assert profile["Simulation"]["Worker Utilization"] < 0.01, profile["Simulation"]
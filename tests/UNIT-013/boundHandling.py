@@ -0,0 +1,38 @@
+#!/usr/bin/env python3
+import korali
+
+# The minimum of (x-12)^2 lies outside the variable bounds, so the optimum is at the upper bound x = 10
+
+def model(s):
+  x = s["Parameters"][0]
+  s["Evaluation"] = (x - 12.0)**2
+
+for boundHandling in [ "Resample", "Projection", "Reflection" ]:
+  e = korali.Experiment()
+  e["Problem"]["Type"] = "Evaluation/Direct/Basic"
+  e["Problem"]["Objective"] = "Minimize"
+  e["Problem"]["Objective Function"] = model
+
+  e["Variables"][0]["Name"] = "X"
+  e["Variables"][0]["Lower Bound"] = -10.0
+  e["Variables"][0]["Upper Bound"] = +10.0
+
+  e["Solver"]["Type"] = "Optimizer/CMAES"
+  e["Solver"]["Population Size"] = 8
+  e["Solver"]["Bound Handling"] = boundHandling
+  e["Solver"]["Termination Criteria"]["Max Generations"] = 100
+
+  e["Console"]["Verbosity"] = "Silent"
+  e["Results"]["Enabled"] = False
+
+  k = korali.Engine()
+  k.run(e)
+
+  xopt = e["Solver"]["Internal"]["Best Ever Variables"][0]
+  print(boundHandling + ": " + str(xopt))
+
+  assert xopt <= 10.0
+  assert abs(xopt - 10.0) < 1e-3
+
+  # Projected samples land exactly on the bound
+  if (boundHandling == "Projection"): assert xopt == 10.0
@@ -0,0 +1,9 @@
+#!/bin/bash
+
+source ../functions.sh
+
+############# STEP 1 ##############
+
+logEcho "[Korali] Running boundHandling.py..."
+./boundHandling.py >> $logFile
+check_result
@@ -0,0 +1,47 @@
+#!/usr/bin/env python3
+import korali
+
+# Minimizes a shifted ellipsoid with correlated variables, whose minimum is at x_i = 1
+
+N = 10
+
+def model(s):
+  x = s["Parameters"]
+  y = [ x[i] - 1.0 for i in range(N) ]
+  f = 0.0
+  for i in range(N): f += (10.0**(2.0*i/(N-1))) * y[i]**2
+  for i in range(N-1): f += (y[i] + y[i+1])**2
+  s["Evaluation"] = f
+
+for covarianceMatrixType in [ "Full", "Separable", "VD" ]:
+  e = korali.Experiment()
+  e["Problem"]["Type"] = "Evaluation/Direct/Basic"
+  e["Problem"]["Objective"] = "Minimize"
+  e["Problem"]["Objective Function"] = model
+
+  for i in range(N):
+    e["Variables"][i]["Name"] = "X" + str(i)
+    e["Variables"][i]["Lower Bound"] = -10.0
+    e["Variables"][i]["Upper Bound"] = +10.0
+
+  e["Solver"]["Type"] = "Optimizer/CMAES"
+  e["Solver"]["Population Size"] = 12
+  e["Solver"]["Covariance Matrix Type"] = covarianceMatrixType
+  e["Solver"]["Termination Criteria"]["Max Generations"] = 1000
+
+  e["Random Seed"] = 1337
+  e["Console"]["Verbosity"] = "Silent"
+  e["Results"]["Enabled"] = False
+
+  k = korali.Engine()
+  k.run(e)
+
+  fopt = e["Solver"]["Internal"]["Best Ever Value"]
+  xopt = e["Solver"]["Internal"]["Best Ever Variables"]
+  print(covarianceMatrixType + ": " + str(fopt))
+
+  # Restricted models only store the diagonal of C
+  if (covarianceMatrixType != "Full"): assert len(e["Solver"]["Internal"]["Covariance Matrix"]) == N
+
+  assert abs(fopt) < 1e-10
+  for i in range(N): assert abs(xopt[i] - 1.0) < 1e-4
@@ -0,0 +1,9 @@
+#!/bin/bash
+
+source ../functions.sh
+
+############# STEP 1 ##############
+
+logEcho "[Korali] Running covarianceMatrixTypes.py..."
+./covarianceMatrixTypes.py >> $logFile
+check_result
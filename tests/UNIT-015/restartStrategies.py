@@ -0,0 +1,50 @@
+#!/usr/bin/env python3
+import korali
+import math
+
+# Minimizes the Rastrigin function, whose local minima trap CMAES with small populations
+
+N = 4
+
+def model(s):
+  x = s["Parameters"]
+  f = 10.0 * N
+  for i in range(N): f += x[i]**2 - 10.0 * math.cos(2.0 * math.pi * x[i])
+  s["Evaluation"] = f
+
+for restartStrategy in [ "IPOP", "BIPOP" ]:
+  e = korali.Experiment()
+  e["Problem"]["Type"] = "Evaluation/Direct/Basic"
+  e["Problem"]["Objective"] = "Minimize"
+  e["Problem"]["Objective Function"] = model
+
+  for i in range(N):
+    e["Variables"][i]["Name"] = "X" + str(i)
+    e["Variables"][i]["Lower Bound"] = -5.12
+    e["Variables"][i]["Upper Bound"] = +5.12
+    e["Variables"][i]["Initial Mean"] = 3.0
+
+  e["Solver"]["Type"] = "Optimizer/CMAES"
+  e["Solver"]["Population Size"] = 8
+  e["Solver"]["Restart Strategy"] = restartStrategy
+  e["Solver"]["Termination Criteria"]["Min Standard Deviation"] = 1e-9
+  e["Solver"]["Termination Criteria"]["Max Restarts"] = 12
+  e["Solver"]["Termination Criteria"]["Max Generations"] = 20000
+
+  e["Console"]["Verbosity"] = "Silent"
+  e["Results"]["Enabled"] = False
+  e["Random Seed"] = 0xC0FFEE
+
+  k = korali.Engine()
+  k["Conduit"]["Type"] = "Simulated"
+  k["Conduit"]["Workers"] = 64
+  k["Conduit"]["Sample Duration"]["Type"] = "Constant"
+  k["Conduit"]["Sample Duration"]["Mean"] = 1.0
+  k.run(e)
+
+  fopt = e["Solver"]["Internal"]["Best Ever Value"]
+  instances = e["Solver"]["Internal"]["Instance Count"]
+  print(restartStrategy + ": " + str(fopt) + " after " + str(instances) + " instances")
+
+  assert instances > 1
+  assert abs(fopt) < 1e-8
@@ -0,0 +1,51 @@
+#!/usr/bin/env python3
+import korali
+
+# Defaults for N = 4: CMAES uses 4+floor(3*log(N)) = 8, and DEA uses 10*N = 40
+
+N = 4
+
+def model(s):
+  x = s["Parameters"]
+  s["Evaluation"] = -sum([ x[i]**2 for i in range(N) ])
+
+def runAuto(solverType, workers, maxWorkers):
+  e = korali.Experiment()
+  e["Problem"]["Type"] = "Evaluation/Direct/Basic"
+  e["Problem"]["Objective"] = "Maximize"
+  e["Problem"]["Objective Function"] = model
+
+  for i in range(N):
+    e["Variables"][i]["Name"] = "X" + str(i)
+    e["Variables"][i]["Lower Bound"] = -5.0
+    e["Variables"][i]["Upper Bound"] = +5.0
+
+  e["Solver"]["Type"] = solverType
+  e["Solver"]["Population Size"] = "Auto"
+  e["Solver"]["Termination Criteria"]["Max Generations"] = 5
+  e["Scheduling"]["Max Workers"] = maxWorkers
+
+  e["Console"]["Verbosity"] = "Silent"
+  e["Results"]["Enabled"] = False
+  e["Random Seed"] = 0xC0FFEE
+
+  k = korali.Engine()
+  k["Conduit"]["Type"] = "Simulated"
+  k["Conduit"]["Workers"] = workers
+  k.run(e)
+
+  populationSize = e["Solver"]["Population Size"]
+  print(solverType + " on " + str(workers) + " worker(s), Max Workers = " + str(maxWorkers) + ": Population Size = " + str(populationSize))
+  return populationSize
+
+# One wave of 12 workers, rather than 8 samples leaving 4 workers idle
+assert runAuto("Optimizer/CMAES", 12, 0) == 12
+
+# Two waves of the 5 workers this experiment can occupy
+assert runAuto("Optimizer/CMAES", 12, 5) == 10
+
+# Three waves of 12 workers, rather than a fourth wave of 4 samples
+assert runAuto("Optimizer/DEA", 12, 0) == 36
+
+# The default already fills whole waves
+assert runAuto("Optimizer/DEA", 8, 0) == 40
@@ -0,0 +1,9 @@
+#!/bin/bash
+
+source ../functions.sh
+
+############# STEP 1 ##############
+
+logEcho "[Korali] Running autoPopulationSize.py..."
+./autoPopulationSize.py >> $logFile
+check_result
@@ -0,0 +1,61 @@
+#!/usr/bin/env python3
+import korali
+
+# The pairs of the mirrored sampling strategies must stay mirrored at the mean they were drawn from,
+# also when one of their samples falls outside the bounds and the pair is drawn again
+
+N = 4
+
+def model(s):
+  x = s["Parameters"]
+  s["Evaluation"] = -sum([ (x[i] - 0.9)**2 for i in range(N) ])
+
+def checkPairs(samplingStrategy, populationSize, maxGenerations):
+  e = korali.Experiment()
+  e["Problem"]["Type"] = "Evaluation/Direct/Basic"
+  e["Problem"]["Objective"] = "Maximize"
+  e["Problem"]["Objective Function"] = model
+
+  for i in range(N):
+    e["Variables"][i]["Name"] = "X" + str(i)
+    e["Variables"][i]["Lower Bound"] = -1.0
+    e["Variables"][i]["Upper Bound"] = +1.0
+    e["Variables"][i]["Initial Mean"] = 0.8
+    e["Variables"][i]["Initial Standard Deviation"] = 0.5
+
+  e["Solver"]["Type"] = "Optimizer/CMAES"
+  e["Solver"]["Population Size"] = populationSize
+  e["Solver"]["Mu Value"] = populationSize // 2
+  e["Solver"]["Use Active Covariance Update"] = True
+  e["Solver"]["Sampling Strategy"] = samplingStrategy
+  e["Solver"]["Termination Criteria"]["Max Generations"] = maxGenerations
+
+  e["Console"]["Verbosity"] = "Silent"
+  e["Results"]["Enabled"] = False
+  e["Random Seed"] = 1337
+
+  k = korali.Engine()
+  k.run(e)
+
+  samples = e["Solver"]["Internal"]["Sample Population"]
+  mean = e["Solver"]["Internal"]["Previous Mean"]
+
+  for j in range(populationSize // 2):
+    for d in range(N):
+      assert abs(samples[2*j][d] + samples[2*j+1][d] - 2.0*mean[d]) < 1e-10, "Pair " + str(j) + " is not mirrored at the mean"
+
+  for x in samples[:populationSize]:
+    for d in range(N):
+      assert -1.0 <= x[d] <= 1.0, "Sample outside the bounds"
+
+  return e["Solver"]["Internal"]["Infeasible Sample Count"]
+
+for samplingStrategy in [ "Mirrored", "Orthogonal" ]:
+  infeasibleSampleCount = 0
+  for populationSize in [ 8, 9 ]:
+    for maxGenerations in [ 1, 2, 5, 20 ]:
+      infeasibleSampleCount += checkPairs(samplingStrategy, populationSize, maxGenerations)
+
+  # The pairs must also have been checked after some of them were drawn again
+  assert infeasibleSampleCount > 0, "No sample was drawn again"
+  print(samplingStrategy + ": pairs mirrored, " + str(infeasibleSampleCount) + " infeasible samples drawn again")
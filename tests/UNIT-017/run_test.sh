@@ -0,0 +1,9 @@
+#!/bin/bash
+
+source ../functions.sh
+
+############# STEP 1 ##############
+
+logEcho "[Korali] Running mirroredPairs.py..."
+./mirroredPairs.py >> $logFile
+check_result